@@ -0,0 +1,390 @@
+/*
+ * codec.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#include "codec.h"
+#include "vector.h"
+
+/* Private function prototypes */
+static inline uint32_t simd_zigzag_s16(int16_t value);
+static inline int16_t simd_unzigzag_s16(uint32_t value);
+static inline uint8_t *simd_bits_put(uint8_t *pOut, uint32_t *pBitBuf,
+    uint32_t *pBitCnt, uint32_t value, uint32_t width);
+static inline uint32_t simd_bits_get(uint8_t **ppIn, uint32_t *pBitBuf,
+    uint32_t *pBitCnt, uint32_t width);
+
+/**
+ * @brief Delta and bit-packing encoder for a S16 vector.
+ * @param[in]       *pSrc points to the 32-bit aligned input vector
+ * @param[out]      *pDst points to the output buffer, of at least SIMD_DELTA_MAX_SIZE(blockSize) bytes
+ * @param[in]       blockSize number of samples in the vector
+ * @return number of bytes written to the output buffer.
+ *
+ * @details
+ * The encoded block is laid out as:
+ * <pre>
+ *     {A[0] low byte, A[0] high byte, width, packed deltas ...}
+ * </pre>
+ * Every delta D[n] = A[n] - A[n-1] is zigzag mapped to an unsigned value
+ * and stored in <code>width</code> bits, least significant bit first.
+ * The width is the smallest one that holds the largest delta of the block,
+ * found with __CLZ. A constant block is encoded in 3 bytes.
+ * \par
+ * The deltas use wrapping arithmetic instead of the saturating simd_sub_s16(),
+ * so the encoding is lossless for any input.
+ * \par
+ * The header does not store the number of samples: the block length is fixed by the
+ * application and carried out of band, e.g. one block per log record of known size.
+ * The encoded size is <code>3 + ceil((blockSize - 1) * width / 8)</code> bytes.
+ */
+uint32_t simd_delta_encode_s16(int16_t *pSrc,
+    uint8_t *pDst,
+    uint32_t blockSize)
+{
+    int16_t *pIn; /* input pointer */
+    uint8_t *pOut = pDst; /* output pointer */
+    uint32_t blkCnt; /* loop counter */
+    uint32_t zigOr = 0U; /* all the zigzag deltas OR-ed together */
+    uint32_t width; /* bits per delta */
+    uint32_t bitBuf = 0U; /* pending output bits */
+    uint32_t bitCnt = 0U; /* number of pending output bits */
+
+    if (blockSize == 0U)
+    {
+        return 0U;
+    }
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t in; /* packed {A[n], A[n+1]} */
+    int32_t last; /* packed {A[n-2], A[n-1]} */
+    int32_t diff; /* packed {D[n], D[n+1]} */
+
+    /* First pass, find the width of the largest delta */
+    if (blockSize > 1U)
+    {
+        /* D[1] from the first pair */
+        pIn = pSrc;
+        last = *__SIMD32(pIn)++;
+        zigOr = simd_zigzag_s16((int16_t) ((last >> 16) - (int16_t) last));
+
+        /*loop Unrolling */
+        blkCnt = (blockSize - 2U) >> 1U;
+
+        /* Compute 2 deltas at a time from aligned pairs.
+         ** {A[n-1], A[n]} is packed from the previous pair and the current one. */
+        while (blkCnt > 0U)
+        {
+            /* D = A[n] - A[n-1] */
+            in = *__SIMD32(pIn)++;
+            diff = __SSUB16(in, __PKHBT16(last >> 16, in));
+            last = in;
+
+            zigOr |= simd_zigzag_s16((int16_t) diff) | simd_zigzag_s16((int16_t) (diff >> 16));
+
+            /* Decrement the loop counter */
+            blkCnt--;
+        }
+
+        /* If the block ends with a single sample, compute its delta here. */
+        if (((blockSize - 2U) & 0x1U) != 0U)
+        {
+            zigOr |= simd_zigzag_s16((int16_t) (*pIn - (int16_t) (last >> 16)));
+        }
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* First pass, find the width of the largest delta */
+    pIn = pSrc + 1;
+    blkCnt = blockSize - 1U;
+
+    while (blkCnt > 0U)
+    {
+        /* D = A[n] - A[n-1] */
+        zigOr |= simd_zigzag_s16((int16_t) (pIn[0] - pIn[-1]));
+        pIn++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    /* Number of significant bits of the largest delta */
+    width = (zigOr == 0U) ? 0U : (32U - __CLZ(zigOr));
+
+    /* Write the header */
+    *pOut++ = (uint8_t) *pSrc;
+    *pOut++ = (uint8_t) ((uint16_t) *pSrc >> 8U);
+    *pOut++ = (uint8_t) width;
+
+    /* A constant block has no packed deltas */
+    if (width == 0U)
+    {
+        return (uint32_t) (pOut - pDst);
+    }
+
+#if defined (USE_MATH_DSP)
+
+    /* Second pass, pack the deltas in the same order */
+    pIn = pSrc;
+    last = *__SIMD32(pIn)++;
+    pOut = simd_bits_put(pOut, &bitBuf, &bitCnt,
+        simd_zigzag_s16((int16_t) ((last >> 16) - (int16_t) last)), width);
+
+    /*loop Unrolling */
+    blkCnt = (blockSize - 2U) >> 1U;
+
+    while (blkCnt > 0U)
+    {
+        /* D = A[n] - A[n-1] */
+        in = *__SIMD32(pIn)++;
+        diff = __SSUB16(in, __PKHBT16(last >> 16, in));
+        last = in;
+
+        /* Append both deltas */
+        pOut = simd_bits_put(pOut, &bitBuf, &bitCnt, simd_zigzag_s16((int16_t) diff), width);
+        pOut = simd_bits_put(pOut, &bitBuf, &bitCnt, simd_zigzag_s16((int16_t) (diff >> 16)), width);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the block ends with a single sample, pack its delta here. */
+    if (((blockSize - 2U) & 0x1U) != 0U)
+    {
+        pOut = simd_bits_put(pOut, &bitBuf, &bitCnt,
+            simd_zigzag_s16((int16_t) (*pIn - (int16_t) (last >> 16))), width);
+    }
+
+#else
+
+    /* Second pass, pack the deltas */
+    pIn = pSrc + 1;
+    blkCnt = blockSize - 1U;
+
+    while (blkCnt > 0U)
+    {
+        /* D = A[n] - A[n-1] */
+        pOut = simd_bits_put(pOut, &bitBuf, &bitCnt,
+            simd_zigzag_s16((int16_t) (pIn[0] - pIn[-1])), width);
+        pIn++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    /* Flush the last partial byte */
+    if (bitCnt > 0U)
+    {
+        *pOut++ = (uint8_t) bitBuf;
+    }
+
+    return (uint32_t) (pOut - pDst);
+}
+
+/**
+ * @brief Delta and bit-packing decoder for a S16 vector.
+ * @param[in]       *pSrc points to the encoded block, as written by simd_delta_encode_s16()
+ * @param[in]       srcLen number of bytes available at pSrc
+ * @param[out]      *pDst points to the 32-bit aligned output vector
+ * @param[in]       blockSize number of samples in the vector, the same as given to the encoder
+ * @return number of bytes read from the encoded block,
+ *         or 0 when the block is corrupt or truncated, pDst is then left unchanged.
+ *
+ * @details
+ * The header is checked before anything is written to <code>pDst</code>: the width must be
+ * at most 16 bits and the packed deltas of <code>blockSize</code> samples,
+ * <code>3 + ceil((blockSize - 1) * width / 8)</code> bytes, must fit in <code>srcLen</code>.
+ * No byte past <code>pSrc + srcLen</code> is read.
+ */
+uint32_t simd_delta_decode_s16(uint8_t *pSrc,
+    uint32_t srcLen,
+    int16_t *pDst,
+    uint32_t blockSize)
+{
+    uint8_t *pIn = pSrc; /* input pointer */
+    uint32_t blkCnt; /* loop counter */
+    uint32_t width; /* bits per delta */
+    uint32_t bitBuf = 0U; /* pending input bits */
+    uint32_t bitCnt = 0U; /* number of pending input bits */
+    int16_t prev; /* previous sample */
+
+    if ((blockSize == 0U) || (srcLen < 3U))
+    {
+        return 0U;
+    }
+
+    /* Read and check the header */
+    prev = (int16_t) ((uint16_t) pIn[0] | ((uint16_t) pIn[1] << 8U));
+    width = pIn[2];
+    pIn += 3;
+
+    if (width > 16U)
+    {
+        return 0U;
+    }
+
+    /* The packed deltas must fit in the encoded block */
+    if (((((uint64_t) (blockSize - 1U) * width) + 7U) >> 3U) > (uint64_t) (srcLen - 3U))
+    {
+        return 0U;
+    }
+
+    /* A constant block has no packed deltas */
+    if (width == 0U)
+    {
+        simd_fill_s16(prev, pDst, blockSize);
+        return (uint32_t) (pIn - pSrc);
+    }
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int16_t out1; /* first output */
+
+    if (blockSize == 1U)
+    {
+        *pDst = prev;
+        return (uint32_t) (pIn - pSrc);
+    }
+
+    /* A[1] = A[0] + D[1], stored with A[0] so the next pairs stay aligned */
+    out1 = prev;
+    prev = (int16_t) (out1 + simd_unzigzag_s16(simd_bits_get(&pIn, &bitBuf, &bitCnt, width)));
+    *__SIMD32(pDst)++ = __PKHBT16(out1, prev);
+
+    /*loop Unrolling */
+    blkCnt = (blockSize - 2U) >> 1U;
+
+    /* Compute 2 outputs at a time.
+     ** a second loop below computes the remaining sample. */
+    while (blkCnt > 0U)
+    {
+        /* A[n] = A[n-1] + D[n] */
+        out1 = (int16_t) (prev + simd_unzigzag_s16(simd_bits_get(&pIn, &bitBuf, &bitCnt, width)));
+        prev = (int16_t) (out1 + simd_unzigzag_s16(simd_bits_get(&pIn, &bitBuf, &bitCnt, width)));
+
+        /* Store the two outputs in the destination buffer, in a single cycle */
+        *__SIMD32(pDst)++ = __PKHBT16(out1, prev);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the block ends with a single sample, compute it here. */
+    blkCnt = (blockSize - 2U) & 0x1U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    *pDst++ = prev;
+
+    /* Loop over the deltas */
+    blkCnt = blockSize - 1U;
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+        /* A[n] = A[n-1] + D[n] */
+        prev = (int16_t) (prev + simd_unzigzag_s16(simd_bits_get(&pIn, &bitBuf, &bitCnt, width)));
+        *pDst++ = prev;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    return (uint32_t) (pIn - pSrc);
+}
+
+/**
+ * @brief Zigzag maps a signed delta to an unsigned value: 0, -1, 1, -2, ... to 0, 1, 2, 3, ...
+ * @param[in]       value signed delta
+ * @return unsigned 16-bit value.
+ */
+static inline uint32_t simd_zigzag_s16(int16_t value)
+{
+    return (uint16_t) (((uint32_t) value << 1U) ^ (uint32_t) (value >> 15));
+}
+
+/**
+ * @brief Inverse of the zigzag mapping.
+ * @param[in]       value unsigned 16-bit value
+ * @return signed delta.
+ */
+static inline int16_t simd_unzigzag_s16(uint32_t value)
+{
+    return (int16_t) ((value >> 1U) ^ (0U - (value & 0x1U)));
+}
+
+/**
+ * @brief Appends a value to the bit stream and writes out the completed bytes.
+ * @param[out]      *pOut points to the output buffer
+ * @param[in,out]   *pBitBuf pending output bits
+ * @param[in,out]   *pBitCnt number of pending output bits, below 8
+ * @param[in]       value value to append
+ * @param[in]       width number of bits of the value, up to 16
+ * @return updated output pointer.
+ */
+static inline uint8_t *simd_bits_put(uint8_t *pOut,
+    uint32_t *pBitBuf,
+    uint32_t *pBitCnt,
+    uint32_t value,
+    uint32_t width)
+{
+    uint32_t bitBuf = *pBitBuf | (value << *pBitCnt);
+    uint32_t bitCnt = *pBitCnt + width;
+
+    while (bitCnt >= 8U)
+    {
+        *pOut++ = (uint8_t) bitBuf;
+        bitBuf >>= 8U;
+        bitCnt -= 8U;
+    }
+
+    *pBitBuf = bitBuf;
+    *pBitCnt = bitCnt;
+    return pOut;
+}
+
+/**
+ * @brief Reads a value from the bit stream, fetching only the bytes it needs.
+ * @param[in,out]   **ppIn points to the input pointer
+ * @param[in,out]   *pBitBuf pending input bits
+ * @param[in,out]   *pBitCnt number of pending input bits
+ * @param[in]       width number of bits of the value, 1 to 16
+ * @return value.
+ */
+static inline uint32_t simd_bits_get(uint8_t **ppIn,
+    uint32_t *pBitBuf,
+    uint32_t *pBitCnt,
+    uint32_t width)
+{
+    uint32_t bitBuf = *pBitBuf;
+    uint32_t bitCnt = *pBitCnt;
+    uint32_t value;
+
+    while (bitCnt < width)
+    {
+        bitBuf |= (uint32_t) *(*ppIn)++ << bitCnt;
+        bitCnt += 8U;
+    }
+
+    value = bitBuf & ((1U << width) - 1U);
+    *pBitBuf = bitBuf >> width;
+    *pBitCnt = bitCnt - width;
+    return value;
+}
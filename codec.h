@@ -0,0 +1,24 @@
+/*
+ * codec.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#ifndef MATH_S16_CODEC_H_
+#define MATH_S16_CODEC_H_
+
+#include "math.h"
+
+/**
+ * @brief Worst case size, in bytes, of an encoded block of N samples.
+ */
+#define SIMD_DELTA_MAX_SIZE(N)      (3U + (2U * (N)))
+
+/* Public function prototypes */
+uint32_t simd_delta_encode_s16(int16_t *pSrc, uint8_t *pDst,
+    uint32_t blockSize);
+uint32_t simd_delta_decode_s16(uint8_t *pSrc, uint32_t srcLen,
+    int16_t *pDst, uint32_t blockSize);
+
+#endif /* MATH_S16_CODEC_H_ */
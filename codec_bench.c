@@ -0,0 +1,123 @@
+/*
+ * codec_bench.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ *
+ * Benchmark of the delta codec, timed with the DWT cycle counter.
+ * DWT, CoreDebug and SystemCoreClock come from the CMSIS device header,
+ * select it when compiling this file, e.g.
+ *     -DSIMD_DEVICE_HEADER=\"stm32f4xx.h\"
+ * The file compiles to nothing without it. Cortex-M0 has no DWT cycle counter.
+ */
+
+#if defined (SIMD_DEVICE_HEADER)
+
+#include SIMD_DEVICE_HEADER
+#include "codec_bench.h"
+#include "tables.h"
+
+/**
+ * @brief Generates a representative S16 test block: two tones plus low level noise.
+ * @param[out]      *pDst points to the output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * @details
+ * The tones are read from the twiddle table, the noise comes from a linear congruential generator.
+ */
+void simd_delta_bench_signal_s16(int16_t *pDst,
+    uint32_t blockSize)
+{
+    uint32_t seed = 12345U; /* noise generator state */
+    uint32_t n; /* sample index */
+    uint32_t phase; /* tone phase, 256 steps per period */
+    int32_t tone1; /* first tone */
+    int32_t tone2; /* second tone */
+
+    for (n = 0U; n < blockSize; n++)
+    {
+        /* sin(2 * pi * phase / 256), the table holds the first half of the period */
+        phase = n & 0xFFU;
+        tone1 = (phase < 128U) ? simd_twiddle_256_s16[(2U * phase) + 1U]
+            : -simd_twiddle_256_s16[(2U * (phase - 128U)) + 1U];
+
+        phase = (n * 7U) & 0xFFU;
+        tone2 = (phase < 128U) ? simd_twiddle_256_s16[(2U * phase) + 1U]
+            : -simd_twiddle_256_s16[(2U * (phase - 128U)) + 1U];
+
+        /* Noise in [-64 63] */
+        seed = (seed * 1664525U) + 1013904223U;
+
+        pDst[n] = (int16_t) ((tone1 >> 1) + (tone2 >> 4) + (int32_t) (seed >> 25) - 64);
+    }
+}
+
+/**
+ * @brief Measures the compression ratio and the throughput of the delta codec.
+ * @param[in]       *pSrc points to the 32-bit aligned input block, e.g. from simd_delta_bench_signal_s16()
+ * @param[out]      *pPacked points to the encode buffer, of at least SIMD_DELTA_MAX_SIZE(blockSize) bytes
+ * @param[out]      *pDecoded points to the 32-bit aligned decode buffer, of blockSize samples
+ * @param[in]       blockSize number of samples in the block
+ * @param[out]      *pResult points to the benchmark result
+ * @return none.
+ *
+ * @details
+ * Encode and decode are each run SIMD_DELTA_BENCH_RUNS times and the average is reported:
+ * <pre>
+ *     ratio = 2 * blockSize / encodedBytes
+ *     MB/s  = 2 * blockSize * SystemCoreClock / cycles / 1e6
+ * </pre>
+ */
+void simd_delta_bench_s16(int16_t *pSrc,
+    uint8_t *pPacked,
+    int16_t *pDecoded,
+    uint32_t blockSize,
+    simd_delta_bench_result_s16 *pResult)
+{
+    uint32_t start; /* cycle counter at the start */
+    uint32_t run; /* run counter */
+    uint32_t n; /* sample index */
+
+    /* Enable the DWT cycle counter */
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    /* Encode */
+    start = DWT->CYCCNT;
+    for (run = 0U; run < SIMD_DELTA_BENCH_RUNS; run++)
+    {
+        pResult->encodedBytes = simd_delta_encode_s16(pSrc, pPacked, blockSize);
+    }
+    pResult->encodeCycles = (DWT->CYCCNT - start) / SIMD_DELTA_BENCH_RUNS;
+
+    /* Decode */
+    start = DWT->CYCCNT;
+    for (run = 0U; run < SIMD_DELTA_BENCH_RUNS; run++)
+    {
+        simd_delta_decode_s16(pPacked, pResult->encodedBytes, pDecoded, blockSize);
+    }
+    pResult->decodeCycles = (DWT->CYCCNT - start) / SIMD_DELTA_BENCH_RUNS;
+
+    /* Check the round trip */
+    pResult->lossless = 1U;
+    for (n = 0U; n < blockSize; n++)
+    {
+        if (pDecoded[n] != pSrc[n])
+        {
+            pResult->lossless = 0U;
+        }
+    }
+
+    /* ratio = 2 * N / size, MB/s = bytes * SystemCoreClock / cycles */
+    pResult->rawBytes = 2U * blockSize;
+    pResult->ratio = (pResult->encodedBytes > 0U)
+        ? ((float) pResult->rawBytes / (float) pResult->encodedBytes) : 0.0f;
+    pResult->encodeMBps = (pResult->encodeCycles > 0U)
+        ? ((float) pResult->rawBytes * (float) SystemCoreClock / (float) pResult->encodeCycles / 1e6f) : 0.0f;
+    pResult->decodeMBps = (pResult->decodeCycles > 0U)
+        ? ((float) pResult->rawBytes * (float) SystemCoreClock / (float) pResult->decodeCycles / 1e6f) : 0.0f;
+}
+
+#endif /* #if defined (SIMD_DEVICE_HEADER) */
@@ -0,0 +1,40 @@
+/*
+ * codec_bench.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#ifndef MATH_S16_CODEC_BENCH_H_
+#define MATH_S16_CODEC_BENCH_H_
+
+#include "codec.h"
+
+/**
+ * @brief Number of encode and decode runs averaged by the benchmark.
+ */
+#ifndef SIMD_DELTA_BENCH_RUNS
+#define SIMD_DELTA_BENCH_RUNS       (16U)
+#endif
+
+/**
+ * @brief Result of the delta codec benchmark.
+ */
+typedef struct
+{
+    uint32_t rawBytes; /* size of the input block, 2 * blockSize */
+    uint32_t encodedBytes; /* size of the encoded block */
+    uint32_t encodeCycles; /* average cycles of one encode */
+    uint32_t decodeCycles; /* average cycles of one decode */
+    float ratio; /* compression ratio, rawBytes / encodedBytes */
+    float encodeMBps; /* encode throughput, in MB/s of raw samples */
+    float decodeMBps; /* decode throughput, in MB/s of raw samples */
+    uint8_t lossless; /* 1 when the decoded block matches the input */
+} simd_delta_bench_result_s16;
+
+/* Public function prototypes */
+void simd_delta_bench_signal_s16(int16_t *pDst, uint32_t blockSize);
+void simd_delta_bench_s16(int16_t *pSrc, uint8_t *pPacked, int16_t *pDecoded,
+    uint32_t blockSize, simd_delta_bench_result_s16 *pResult);
+
+#endif /* MATH_S16_CODEC_BENCH_H_ */
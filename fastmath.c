@@ -0,0 +1,523 @@
+/*
+ * fastmath.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#include "fastmath.h"
+#include "tables.h"
+
+/* Private function prototypes */
+static inline uint32_t simd_sqrt_core(uint32_t in);
+static inline uint32_t simd_recip_core(uint32_t in, int8_t *pShift);
+static inline int32_t simd_log2_core(uint32_t in);
+static inline int16_t simd_sqrt_one_s16(int16_t in);
+static inline int16_t simd_recip_one_s16(int16_t in, int8_t *pShift);
+static inline int16_t simd_log2_one_s16(int16_t in);
+
+/**
+ * @brief S16 vector square root.
+ * @param[in]       *pSrc points to the input vector, in 1.15 format
+ * @param[out]      *pDst points to the output vector, in 1.15 format
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * @details
+ * The input is normalized with __CLZ, an initial 1/sqrt estimate is interpolated
+ * from a 25 entries table and refined with one Newton-Raphson step.
+ * Negative inputs return 0.
+ * \par
+ * Maximum error: 1 LSB.
+ */
+void simd_sqrt_s16(int16_t *pSrc,
+    int16_t *pDst,
+    uint32_t blockSize)
+{
+    uint32_t blkCnt; /* loop counter */
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t in; /* packed input */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+        /* C = sqrt(A) */
+        /* Read two inputs, compute and then store the packed results in the destination buffer. */
+        in = *__SIMD32(pSrc)++;
+        *__SIMD32(pDst)++ = __PKHBT16(simd_sqrt_one_s16((int16_t) in),
+            simd_sqrt_one_s16((int16_t) (in >> 16)));
+
+        in = *__SIMD32(pSrc)++;
+        *__SIMD32(pDst)++ = __PKHBT16(simd_sqrt_one_s16((int16_t) in),
+            simd_sqrt_one_s16((int16_t) (in >> 16)));
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+        /* C = sqrt(A) */
+        *pDst++ = simd_sqrt_one_s16(*pSrc++);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief S32 vector square root.
+ * @param[in]       *pSrc points to the input vector, in 1.31 format
+ * @param[out]      *pDst points to the output vector, in 1.31 format
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * @details
+ * Same algorithm as simd_sqrt_s16(). Negative inputs return 0.
+ * \par
+ * Maximum error: 2^-19 (4096 LSB), limited by the single Newton-Raphson step.
+ */
+void simd_sqrt_s32(int32_t *pSrc,
+    int32_t *pDst,
+    uint32_t blockSize)
+{
+    uint32_t blkCnt = blockSize; /* loop counter */
+    uint32_t out; /* output value */
+    int32_t in; /* input value */
+
+    while (blkCnt > 0U)
+    {
+        /* C = sqrt(A) */
+        in = *pSrc++;
+        out = (in > 0) ? simd_sqrt_core((uint32_t) in) : 0U;
+
+        /* Saturate to 1.31 format */
+        *pDst++ = (out > 0x7FFFFFFFU) ? 0x7FFFFFFF : (int32_t) out;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief S16 vector reciprocal.
+ * @param[in]       *pSrc points to the input vector, in 1.15 format
+ * @param[out]      *pDst points to the output vector, in 1.15 format
+ * @param[out]      *pShift points to the output exponent vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * @details
+ * The reciprocal is returned as a mantissa and an exponent: 1/A = pDst * 2^pShift,
+ * with |pDst| in [0.5 1) and pShift in [1 16].
+ * The input is normalized with __CLZ, an initial estimate is interpolated
+ * from a 33 entries table and refined with one Newton-Raphson step.
+ * A zero input returns the saturated value 0x7FFF with a shift of 16.
+ * \par
+ * Maximum error of the mantissa: 1 LSB.
+ */
+void simd_recip_s16(int16_t *pSrc,
+    int16_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize)
+{
+    uint32_t blkCnt; /* loop counter */
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t in; /* packed input */
+    int16_t out1; /* first output */
+    int16_t out2; /* second output */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+        /* C = 1 / A */
+        /* Read two inputs, compute and then store the packed results in the destination buffer. */
+        in = *__SIMD32(pSrc)++;
+        out1 = simd_recip_one_s16((int16_t) in, pShift++);
+        out2 = simd_recip_one_s16((int16_t) (in >> 16), pShift++);
+        *__SIMD32(pDst)++ = __PKHBT16(out1, out2);
+
+        in = *__SIMD32(pSrc)++;
+        out1 = simd_recip_one_s16((int16_t) in, pShift++);
+        out2 = simd_recip_one_s16((int16_t) (in >> 16), pShift++);
+        *__SIMD32(pDst)++ = __PKHBT16(out1, out2);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+        /* C = 1 / A */
+        *pDst++ = simd_recip_one_s16(*pSrc++, pShift++);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief S32 vector reciprocal.
+ * @param[in]       *pSrc points to the input vector, in 1.31 format
+ * @param[out]      *pDst points to the output vector, in 1.31 format
+ * @param[out]      *pShift points to the output exponent vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * @details
+ * Same algorithm as simd_recip_s16(): 1/A = pDst * 2^pShift,
+ * with |pDst| in [0.5 1) and pShift in [1 32].
+ * A zero input returns the saturated value 0x7FFFFFFF with a shift of 32.
+ * \par
+ * Maximum relative error of the mantissa: 2^-23.
+ */
+void simd_recip_s32(int32_t *pSrc,
+    int32_t *pDst,
+    int8_t *pShift,
+    uint32_t blockSize)
+{
+    uint32_t blkCnt = blockSize; /* loop counter */
+    uint32_t mag; /* magnitude of the input */
+    uint32_t out; /* output value */
+    int32_t in; /* input value */
+
+    while (blkCnt > 0U)
+    {
+        /* C = 1 / A */
+        in = *pSrc++;
+
+        if (in == 0)
+        {
+            /* Saturate the reciprocal of zero */
+            *pDst++ = 0x7FFFFFFF;
+            *pShift++ = 32;
+        }
+        else
+        {
+            /* The reciprocal is computed on the magnitude, -1.0 is clipped to the largest positive value */
+            mag = (in > 0) ? (uint32_t) in : (0U - (uint32_t) in);
+            mag = (mag > 0x7FFFFFFFU) ? 0x7FFFFFFFU : mag;
+            out = simd_recip_core(mag, pShift++);
+
+            /* Saturate to 1.31 format and restore the sign */
+            out = (out > 0x7FFFFFFFU) ? 0x7FFFFFFFU : out;
+            *pDst++ = (in > 0) ? (int32_t) out : -(int32_t) out;
+        }
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief S16 vector base-2 logarithm.
+ * @param[in]       *pSrc points to the input vector, in 1.15 format
+ * @param[out]      *pDst points to the output vector, in 5.11 format
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * @details
+ * The input is normalized with __CLZ, the leading zeros give the integer part
+ * and the fractional part is interpolated from a 33 entries table.
+ * The output is in the range [-15 0], non-positive inputs return -16 (0x8000).
+ * The result converts to decibels as 20 * log10(A) = 6.0206 * log2(A).
+ * \par
+ * Maximum error: 2^-11 (1 LSB).
+ */
+void simd_log2_s16(int16_t *pSrc,
+    int16_t *pDst,
+    uint32_t blockSize)
+{
+    uint32_t blkCnt; /* loop counter */
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t in; /* packed input */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+        /* C = log2(A) */
+        /* Read two inputs, compute and then store the packed results in the destination buffer. */
+        in = *__SIMD32(pSrc)++;
+        *__SIMD32(pDst)++ = __PKHBT16(simd_log2_one_s16((int16_t) in),
+            simd_log2_one_s16((int16_t) (in >> 16)));
+
+        in = *__SIMD32(pSrc)++;
+        *__SIMD32(pDst)++ = __PKHBT16(simd_log2_one_s16((int16_t) in),
+            simd_log2_one_s16((int16_t) (in >> 16)));
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+        /* C = log2(A) */
+        *pDst++ = simd_log2_one_s16(*pSrc++);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief S32 vector base-2 logarithm.
+ * @param[in]       *pSrc points to the input vector, in 1.31 format
+ * @param[out]      *pDst points to the output vector, in 6.26 format
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * @details
+ * Same algorithm as simd_log2_s16(). The output is in the range [-31 0),
+ * non-positive inputs return -32 (0x80000000).
+ * \par
+ * Maximum error: 2^-12, limited by the linear interpolation.
+ */
+void simd_log2_s32(int32_t *pSrc,
+    int32_t *pDst,
+    uint32_t blockSize)
+{
+    uint32_t blkCnt = blockSize; /* loop counter */
+    int32_t in; /* input value */
+
+    while (blkCnt > 0U)
+    {
+        /* C = log2(A) */
+        in = *pSrc++;
+        *pDst++ = (in > 0) ? simd_log2_core((uint32_t) in) : INT32_MIN;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief Square root of a positive 1.31 value.
+ * @param[in]       in input value, in the range (0 0x7FFFFFFF]
+ * @return square root in unsigned 1.31 format, may exceed 0x7FFFFFFF by a few LSB.
+ */
+static inline uint32_t simd_sqrt_core(uint32_t in)
+{
+    uint32_t n; /* normalization shift, even */
+    uint32_t m; /* normalized input in [0.25 1) */
+    uint32_t idx; /* table index */
+    int32_t frac; /* interpolation fraction, 16 bits */
+    uint32_t u; /* 1 / (2 * sqrt(m)) in unsigned 1.31 format */
+    uint32_t t; /* temporary variable */
+
+    /* Normalize by an even number of bits, so the exponent can be halved */
+    n = (__CLZ(in) - 1U) & ~0x1U;
+    m = in << n;
+
+    /* Interpolate the initial estimate of 1 / (2 * sqrt(m)) */
+    idx = (m >> 26U) - 8U;
+    frac = (int32_t) ((m >> 10U) & 0xFFFFU);
+    u = ((uint32_t) simd_rsqrt_table_u16[idx] << 16U)
+        + (uint32_t) (((int32_t) simd_rsqrt_table_u16[idx + 1U]
+            - (int32_t) simd_rsqrt_table_u16[idx]) * frac);
+
+    /* One Newton-Raphson step: u = u * (3 - 4 * m * u^2) / 2 */
+    t = (uint32_t) (((uint64_t) u * u) >> 31U);
+    t = (uint32_t) (((uint64_t) m * t) >> 29U);
+    u = (uint32_t) (((uint64_t) u * ((3ULL << 31U) - t)) >> 32U);
+
+    /* sqrt(m) = m * 2 * u */
+    t = (uint32_t) (((uint64_t) m * u) >> 30U);
+
+    /* Undo the normalization with rounding: sqrt(A) = sqrt(m) * 2^(-n/2) */
+    n >>= 1U;
+    return (n > 0U) ? ((t + (1U << (n - 1U))) >> n) : t;
+}
+
+/**
+ * @brief Reciprocal of a positive 1.31 value.
+ * @param[in]       in input value, in the range (0 0x7FFFFFFF]
+ * @param[out]      *pShift exponent of the result
+ * @return mantissa in unsigned 1.31 format, in the range (0.5 1].
+ */
+static inline uint32_t simd_recip_core(uint32_t in,
+    int8_t *pShift)
+{
+    uint32_t n; /* normalization shift */
+    uint32_t m; /* normalized input in [0.5 1) */
+    uint32_t idx; /* table index */
+    int32_t frac; /* interpolation fraction, 16 bits */
+    uint32_t r; /* 1 / (2 * m) in unsigned 1.31 format */
+    uint32_t t; /* temporary variable */
+
+    /* Normalize the input */
+    n = __CLZ(in) - 1U;
+    m = in << n;
+
+    /* Interpolate the initial estimate of 1 / (2 * m) */
+    idx = (m >> 25U) & 0x1FU;
+    frac = (int32_t) ((m >> 9U) & 0xFFFFU);
+    r = ((uint32_t) simd_recip_table_u16[idx] << 16U)
+        + (uint32_t) (((int32_t) simd_recip_table_u16[idx + 1U]
+            - (int32_t) simd_recip_table_u16[idx]) * frac);
+
+    /* One Newton-Raphson step: r = r * (2 - 2 * m * r) */
+    t = (uint32_t) (((uint64_t) m * r) >> 30U);
+    r = (uint32_t) (((uint64_t) r * ((1ULL << 32U) - t)) >> 31U);
+
+    /* 1 / A = 2^n / m = r * 2^(n + 1) */
+    *pShift = (int8_t) (n + 1U);
+
+    return r;
+}
+
+/**
+ * @brief Base-2 logarithm of a positive 1.31 value.
+ * @param[in]       in input value, in the range (0 0x7FFFFFFF]
+ * @return logarithm in 6.26 format.
+ */
+static inline int32_t simd_log2_core(uint32_t in)
+{
+    uint32_t n; /* normalization shift */
+    uint32_t m; /* normalized input in [1 2) */
+    uint32_t idx; /* table index */
+    int32_t frac; /* interpolation fraction, 16 bits */
+    int32_t out; /* log2(m) in 6.26 format */
+
+    /* Normalize the input, the leading one is bit 31 */
+    n = __CLZ(in);
+    m = in << n;
+
+    /* Interpolate log2(m) */
+    idx = (m >> 26U) & 0x1FU;
+    frac = (int32_t) ((m >> 10U) & 0xFFFFU);
+    out = ((int32_t) simd_log2_table_u16[idx] << 11U)
+        + ((((int32_t) simd_log2_table_u16[idx + 1U]
+            - (int32_t) simd_log2_table_u16[idx]) * frac) >> 5U);
+
+    /* log2(A) = log2(m) - n */
+    return out - (int32_t) (n << 26U);
+}
+
+/**
+ * @brief Square root of a 1.15 value.
+ * @param[in]       in input value
+ * @return square root in 1.15 format.
+ */
+static inline int16_t simd_sqrt_one_s16(int16_t in)
+{
+    uint32_t out; /* square root in unsigned 1.31 format */
+
+    if (in <= 0)
+    {
+        return 0;
+    }
+
+    /* Convert from 1.31 to 1.15 format with rounding and saturate */
+    out = (simd_sqrt_core((uint32_t) in << 16U) + 0x8000U) >> 16U;
+    return (out > 0x7FFFU) ? 0x7FFF : (int16_t) out;
+}
+
+/**
+ * @brief Reciprocal of a 1.15 value.
+ * @param[in]       in input value
+ * @param[out]      *pShift exponent of the result
+ * @return mantissa in 1.15 format.
+ */
+static inline int16_t simd_recip_one_s16(int16_t in,
+    int8_t *pShift)
+{
+    uint32_t mag; /* magnitude of the input */
+    uint32_t out; /* mantissa */
+
+    if (in == 0)
+    {
+        /* Saturate the reciprocal of zero */
+        *pShift = 16;
+        return 0x7FFF;
+    }
+
+    /* The reciprocal is computed on the magnitude, -1.0 is clipped to the largest positive value */
+    mag = (uint32_t) ((in > 0) ? in : -in) << 16U;
+    mag = (mag > 0x7FFFFFFFU) ? 0x7FFFFFFFU : mag;
+
+    /* Convert from 1.31 to 1.15 format with rounding and saturate */
+    out = (simd_recip_core(mag, pShift) + 0x8000U) >> 16U;
+    out = (out > 0x7FFFU) ? 0x7FFFU : out;
+
+    /* Restore the sign */
+    return (in > 0) ? (int16_t) out : (int16_t) -(int32_t) out;
+}
+
+/**
+ * @brief Base-2 logarithm of a 1.15 value.
+ * @param[in]       in input value
+ * @return logarithm in 5.11 format.
+ */
+static inline int16_t simd_log2_one_s16(int16_t in)
+{
+    if (in <= 0)
+    {
+        return INT16_MIN;
+    }
+
+    /* Convert from 6.26 to 5.11 format with rounding */
+    return (int16_t) ((simd_log2_core((uint32_t) in << 16U) + 0x4000) >> 15U);
+}
@@ -0,0 +1,23 @@
+/*
+ * fastmath.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#ifndef MATH_S16_FASTMATH_H_
+#define MATH_S16_FASTMATH_H_
+
+#include "math.h"
+
+/* Public function prototypes */
+void simd_sqrt_s16(int16_t *pSrc, int16_t *pDst, uint32_t blockSize);
+void simd_sqrt_s32(int32_t *pSrc, int32_t *pDst, uint32_t blockSize);
+void simd_recip_s16(int16_t *pSrc, int16_t *pDst, int8_t *pShift,
+    uint32_t blockSize);
+void simd_recip_s32(int32_t *pSrc, int32_t *pDst, int8_t *pShift,
+    uint32_t blockSize);
+void simd_log2_s16(int16_t *pSrc, int16_t *pDst, uint32_t blockSize);
+void simd_log2_s32(int32_t *pSrc, int32_t *pDst, uint32_t blockSize);
+
+#endif /* MATH_S16_FASTMATH_H_ */
@@ -0,0 +1,286 @@
+/*
+ * filter.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#include "filter.h"
+#include "vector.h"
+
+/**
+ * @brief Initialization function for the S16 Biquad cascade filter.
+ * @param[in,out]   *S points to an instance of the S16 Biquad cascade structure
+ * @param[in]       numStages number of 2nd order stages in the filter
+ * @param[in]       *pCoeffs points to the 32-bit aligned filter coefficients
+ * @param[in]       *pState points to the 32-bit aligned state buffer
+ * @param[in]       postShift shift to be applied to the accumulator result, in the range [0 15]
+ * @return none.
+ *
+ * <b>Coefficient and State Ordering:</b>
+ * \par
+ * The coefficients are stored in the array <code>pCoeffs</code> in the following order:
+ * <pre>
+ *     {b10, 0, b11, b12, a11, a12, b20, 0, b21, b22, a21, a22, ...}
+ * </pre>
+ * where <code>b1x</code> and <code>a1x</code> are the coefficients for the first stage,
+ * <code>b2x</code> and <code>a2x</code> are the coefficients for the second stage, and so on.
+ * The zero after <code>bx0</code> pads every stage to three packed coefficient pairs
+ * so that the filter can use dual multiply-accumulate instructions.
+ * The feedback coefficients <code>ax1</code> and <code>ax2</code> are stored negated:
+ * <pre>
+ *     y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2]
+ * </pre>
+ * \par
+ * The coefficients are in Q(15 - postShift) format, so a <code>postShift</code> of 1
+ * allows coefficients in the range [-2 +2).
+ * A <code>postShift</code> outside the range [0 15] is saturated to that range.
+ * \par
+ * The state variables are stored in the array <code>pState</code> in the following order:
+ * <pre>
+ *     {x[n-1], x[n-2], y[n-1], y[n-2]}
+ * </pre>
+ * The 4 state variables for stage 1 are first, then the 4 state variables for stage 2, and so on.
+ * The state array has a total length of <code>4*numStages</code> values and is zeroed here.
+ */
+void simd_biquad_cascade_s16_init(simd_biquad_cascade_instance_s16 *S,
+    uint8_t numStages,
+    int16_t *pCoeffs,
+    int16_t *pState,
+    int8_t postShift)
+{
+    /* Assign filter stages */
+    S->numStages = numStages;
+
+    /* Assign postShift to be applied to the output, limited to [0 15] */
+    if (postShift < 0)
+    {
+        postShift = 0;
+    }
+    else if (postShift > 15)
+    {
+        postShift = 15;
+    }
+
+    S->postShift = postShift;
+
+    /* Assign coefficient pointer */
+    S->pCoeffs = pCoeffs;
+
+    /* Clear state buffer and size is always 4 * numStages */
+    simd_fill_s16(0, pState, 4U * (uint32_t) numStages);
+
+    /* Assign state pointer */
+    S->pState = pState;
+}
+
+/**
+ * @brief Processing function for the S16 Biquad cascade filter (Direct Form I).
+ * @param[in]       *S points to an instance of the S16 Biquad cascade structure
+ * @param[in]       *pSrc points to the 32-bit aligned block of input data
+ * @param[out]      *pDst points to the 32-bit aligned block of output data
+ * @param[in]       blockSize number of samples to process
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * The state variables are in 1.15 format and the coefficients are in Q(15 - postShift) format,
+ * so multiplications yield a Q(30 - postShift) result.
+ * The intermediate results are accumulated in a 64-bit accumulator,
+ * so there is no risk of overflow during the accumulation.
+ * The accumulator is then shifted by <code>15 - postShift</code> bits and saturated to 1.15 format.
+ * \par
+ * The input and output buffers may be the same (in-place filtering).
+ * On Cortex-M4 and Cortex-M3 the samples, coefficients and state are accessed as halfword pairs,
+ * so all of them must be 32-bit aligned.
+ */
+void simd_biquad_cascade_s16(const simd_biquad_cascade_instance_s16 *S,
+    int16_t *pSrc,
+    int16_t *pDst,
+    uint32_t blockSize)
+{
+    int16_t *pIn = pSrc; /* Source pointer */
+    int16_t *pOut = pDst; /* Destination pointer */
+    int16_t *pState = S->pState; /* State pointer */
+    int16_t *pCoeffs = S->pCoeffs; /* Coefficient pointer */
+    int64_t acc; /* Accumulator */
+    int32_t out; /* Output sample */
+    int32_t shift = (15 - (int32_t) S->postShift); /* Post shift */
+    uint32_t sample; /* sample loop counter */
+    uint32_t stage = (uint32_t) S->numStages; /* stage loop counter */
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t b0; /* packed {b0, 0} */
+    int32_t b1; /* packed {b1, b2} */
+    int32_t a1; /* packed {a1, a2} */
+    int32_t stateIn; /* packed {x[n-1], x[n-2]} */
+    int32_t stateOut; /* packed {y[n-1], y[n-2]} */
+    int32_t in; /* packed input samples */
+    int32_t out2; /* second output sample */
+
+    while (stage > 0U)
+    {
+        /* Read the coefficient pairs of the current stage */
+        b0 = *__SIMD32(pCoeffs)++;
+        b1 = *__SIMD32(pCoeffs)++;
+        a1 = *__SIMD32(pCoeffs)++;
+
+        /* Read the state of the current stage */
+        stateIn = *__SIMD32(pState)++;
+        stateOut = *__SIMD32(pState)--;
+
+        /*loop Unrolling */
+        sample = blockSize >> 1U;
+
+        /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+         ** a second loop below computes the remaining sample. */
+        while (sample > 0U)
+        {
+            /* Read two inputs */
+            in = *__SIMD32(pIn)++;
+
+            /* y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+            acc = (int64_t) __SMLALD(b0, in, 0);
+            acc = (int64_t) __SMLALD(b1, stateIn, acc);
+            acc = (int64_t) __SMLALD(a1, stateOut, acc);
+
+            /* Shift and saturate the result to 1.15 format */
+            out = __SSAT((int32_t ) (acc >> shift), 16);
+
+            /* Update the state: x[n-2] = x[n-1], x[n-1] = x[n], same for y */
+            stateIn = __PKHBT16(in, stateIn);
+            stateOut = __PKHBT16(out, stateOut);
+
+            /* Move the second input to the lower halfword */
+            in = in >> 16;
+
+            /* y[n+1] = b0 * x[n+1] + b1 * x[n] + b2 * x[n-1] + a1 * y[n] + a2 * y[n-1] */
+            acc = (int64_t) __SMLALD(b0, in, 0);
+            acc = (int64_t) __SMLALD(b1, stateIn, acc);
+            acc = (int64_t) __SMLALD(a1, stateOut, acc);
+
+            out2 = __SSAT((int32_t ) (acc >> shift), 16);
+
+            stateIn = __PKHBT16(in, stateIn);
+            stateOut = __PKHBT16(out2, stateOut);
+
+            /* Store the two outputs in the destination buffer, in a single cycle */
+            *__SIMD32(pOut)++ = __PKHBT16(out, out2);
+
+            /* Decrement the loop counter */
+            sample--;
+        }
+
+        /* If the blockSize is not a multiple of 2, compute the remaining output sample here.
+         ** No loop unrolling is used. */
+        sample = blockSize & 0x1U;
+
+        while (sample > 0U)
+        {
+            /* Read the input */
+            in = *pIn++;
+
+            /* y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+            acc = (int64_t) __SMLALD(b0, in, 0);
+            acc = (int64_t) __SMLALD(b1, stateIn, acc);
+            acc = (int64_t) __SMLALD(a1, stateOut, acc);
+
+            out = __SSAT((int32_t ) (acc >> shift), 16);
+
+            stateIn = __PKHBT16(in, stateIn);
+            stateOut = __PKHBT16(out, stateOut);
+
+            *pOut++ = (int16_t) out;
+
+            /* Decrement the loop counter */
+            sample--;
+        }
+
+        /* The output of this stage is the input of the next stage */
+        pIn = pDst;
+        pOut = pDst;
+
+        /* Store the updated state of the current stage */
+        *__SIMD32(pState)++ = stateIn;
+        *__SIMD32(pState)++ = stateOut;
+
+        /* Decrement the loop counter */
+        stage--;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    int16_t b0, b1, b2, a1, a2; /* Filter coefficients */
+    int16_t Xn1, Xn2, Yn1, Yn2; /* Filter state variables */
+    int16_t Xn; /* Temporary input */
+
+    while (stage > 0U)
+    {
+        /* Read the coefficients of the current stage, skipping the padding after b0 */
+        b0 = *pCoeffs++;
+        pCoeffs++;
+        b1 = *pCoeffs++;
+        b2 = *pCoeffs++;
+        a1 = *pCoeffs++;
+        a2 = *pCoeffs++;
+
+        /* Read the state of the current stage */
+        Xn1 = pState[0];
+        Xn2 = pState[1];
+        Yn1 = pState[2];
+        Yn2 = pState[3];
+
+        /* Initialize sample with number of samples */
+        sample = blockSize;
+
+        while (sample > 0U)
+        {
+            /* Read the input */
+            Xn = *pIn++;
+
+            /* y[n] = b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+            acc = (int64_t) b0 * Xn;
+            acc += (int64_t) b1 * Xn1;
+            acc += (int64_t) b2 * Xn2;
+            acc += (int64_t) a1 * Yn1;
+            acc += (int64_t) a2 * Yn2;
+
+            /* Shift and saturate the result to 1.15 format */
+            out = __SSAT((int32_t ) (acc >> shift), 16);
+
+            /* Update the state: x[n-2] = x[n-1], x[n-1] = x[n], same for y */
+            Xn2 = Xn1;
+            Xn1 = Xn;
+            Yn2 = Yn1;
+            Yn1 = (int16_t) out;
+
+            /* Store the output in the destination buffer */
+            *pOut++ = (int16_t) out;
+
+            /* Decrement the loop counter */
+            sample--;
+        }
+
+        /* The output of this stage is the input of the next stage */
+        pIn = pDst;
+        pOut = pDst;
+
+        /* Store the updated state of the current stage */
+        *pState++ = Xn1;
+        *pState++ = Xn2;
+        *pState++ = Yn1;
+        *pState++ = Yn2;
+
+        /* Decrement the loop counter */
+        stage--;
+    }
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+}
@@ -0,0 +1,30 @@
+/*
+ * filter.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#ifndef MATH_S16_FILTER_H_
+#define MATH_S16_FILTER_H_
+
+#include "math.h"
+
+/**
+ * @brief Instance structure for the S16 Biquad cascade filter (Direct Form I).
+ */
+typedef struct
+{
+    uint8_t numStages; /* number of 2nd order stages in the filter */
+    int16_t *pState; /* points to the array of state coefficients, size 4*numStages */
+    int16_t *pCoeffs; /* points to the array of coefficients, size 6*numStages */
+    int8_t postShift; /* additional shift, in bits, applied to each output sample, in the range [0 15] */
+} simd_biquad_cascade_instance_s16;
+
+/* Public function prototypes */
+void simd_biquad_cascade_s16_init(simd_biquad_cascade_instance_s16 *S,
+    uint8_t numStages, int16_t *pCoeffs, int16_t *pState, int8_t postShift);
+void simd_biquad_cascade_s16(const simd_biquad_cascade_instance_s16 *S,
+    int16_t *pSrc, int16_t *pDst, uint32_t blockSize);
+
+#endif /* MATH_S16_FILTER_H_ */
@@ -42,7 +42,10 @@
 	#define __PKHBT16(ARG1,ARG2)      __nds32__pkbb16(ARG2,ARG1)
 	#define __QADD16                  __nds32__kadd16
 	#define __QSUB16                  __nds32__ksub16
+	#define __SSUB16                  __nds32__sub16
 	#define __SMLAD(ARG1,ARG2,ARG3)   __nds32__smalda((ARG3),(ARG1),(ARG2))
+	#define __SMLALD(ARG1,ARG2,ARG3)  __nds32__smalda((ARG3),(ARG1),(ARG2))
+	#define __SSAT(ARG1,ARG2)         __nds32__clips((ARG1),((ARG2)-1))
 #else
 #include "cmsis_gcc.h"
 #endif
@@ -103,4 +106,8 @@
 #define __PKHBT16(ARG1,ARG2)       __PKHBT((ARG1), (ARG2), 16)
 #endif /* __PKHBT16 */
 
+#ifndef __ALIGNED
+	#define __ALIGNED(x)               __attribute__((aligned(x)))
+#endif /* __ALIGNED */
+
 #endif /* MATH_S16_MATH_H_ */
@@ -0,0 +1,578 @@
+/*
+ * matrix.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#include <string.h>
+#include "matrix.h"
+
+/* Private function prototypes */
+static inline int16_t simd_mat_dot_s16(int16_t *pSrcA, int16_t *pSrcB,
+    uint32_t blockSize);
+static inline int16_t simd_mat_result_s16(int64_t sum);
+#if defined (USE_MATH_DSP)
+static inline int32_t simd_mat_read_pair_s16(int16_t *pSrc);
+#endif /* #if defined (USE_MATH_DSP) */
+
+/**
+ * @brief S16 matrix initialization.
+ * @param[in,out]   *S points to an instance of the S16 matrix structure
+ * @param[in]       nRows number of rows in the matrix
+ * @param[in]       nColumns number of columns in the matrix
+ * @param[in]       *pData points to the matrix data array, stored in row-major order
+ * @return none.
+ */
+void simd_mat_init_s16(simd_matrix_instance_s16 *S,
+    uint16_t nRows,
+    uint16_t nColumns,
+    int16_t *pData)
+{
+    /* Assign Number of Rows */
+    S->numRows = nRows;
+
+    /* Assign Number of Columns */
+    S->numCols = nColumns;
+
+    /* Assign Data pointer */
+    S->pData = pData;
+}
+
+/**
+ * @brief S16 matrix transpose.
+ * @param[in]       *pSrc points to the input matrix
+ * @param[out]      *pDst points to the output matrix, of size numCols x numRows of the input
+ * @return none.
+ */
+void simd_mat_trans_s16(const simd_matrix_instance_s16 *pSrc,
+    simd_matrix_instance_s16 *pDst)
+{
+    int16_t *pIn = pSrc->pData; /* input data matrix pointer */
+    int16_t *pOut; /* output data matrix pointer */
+    uint16_t nRows = pSrc->numRows; /* number of rows */
+    uint16_t nCols = pSrc->numCols; /* number of columns */
+    uint32_t row = 0U; /* row loop counter */
+    uint32_t col; /* column loop counter */
+
+    while (row < nRows)
+    {
+        /* Row of the input is column of the output */
+        pOut = pDst->pData + row;
+        col = nCols;
+
+        while (col > 0U)
+        {
+            /* B[j][i] = A[i][j] */
+            *pOut = *pIn++;
+            pOut += nRows;
+
+            /* Decrement the column loop counter */
+            col--;
+        }
+
+        /* Increment the row loop counter */
+        row++;
+    }
+}
+
+/**
+ * @brief S16 matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrix, of size M x N
+ * @param[in]       *pSrcB points to the second input matrix, of size N x P
+ * @param[out]      *pDst points to the output matrix, of size M x P
+ * @param[in]       *pScratch points to a 32-bit aligned scratch buffer of SIMD_MAT_SCRATCH_LEN(N, P) values
+ * @return none.
+ *
+ * @details
+ * The second matrix is transposed into <code>pScratch</code> first, with every row padded
+ * to an even length, so the inner loop reads aligned halfword pairs of B for the dual
+ * multiply-accumulate. The rows of A are read with unaligned-safe loads.
+ * The scratch buffer is not used on Cortex-M0.
+ * The caller is responsible for matching the matrix dimensions.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * The inputs to the multiplications are in 1.15 format and multiplications yield a 2.30 result.
+ * The 2.30 intermediate results are accumulated in a 64-bit accumulator in 34.30 format.
+ * The result is then truncated to 34.15 format and saturated to 1.15 format.
+ */
+void simd_mat_mult_s16(const simd_matrix_instance_s16 *pSrcA,
+    const simd_matrix_instance_s16 *pSrcB,
+    simd_matrix_instance_s16 *pDst,
+    int16_t *pScratch)
+{
+    int16_t *pInA = pSrcA->pData; /* input data matrix pointer A */
+    int16_t *pInB; /* input data matrix pointer B */
+    int16_t *pOut = pDst->pData; /* output data matrix pointer */
+    uint16_t numRowsA = pSrcA->numRows; /* number of rows of input matrix A */
+    uint16_t numColsA = pSrcA->numCols; /* number of columns of input matrix A */
+    uint16_t numColsB = pSrcB->numCols; /* number of columns of input matrix B */
+    uint32_t row = numRowsA; /* row loop counter */
+    uint32_t col; /* column loop counter */
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    uint32_t stride = ((uint32_t) numColsA + 1U) & ~0x1U; /* padded row length of the transposed B */
+    int16_t *pTrans; /* transposed matrix pointer */
+    uint32_t k; /* inner loop counter */
+
+    /* Transpose B, so every output is a dot product of two contiguous rows */
+    for (col = 0U; col < numColsB; col++)
+    {
+        pInB = pSrcB->pData + col;
+        pTrans = pScratch + (col * stride);
+
+        for (k = 0U; k < numColsA; k++)
+        {
+            *pTrans++ = *pInB;
+            pInB += numColsB;
+        }
+
+        /* Pad odd rows, so the next row starts on a word boundary */
+        if (stride != numColsA)
+        {
+            *pTrans = 0;
+        }
+    }
+
+    while (row > 0U)
+    {
+        /* Start from the first row of the transposed B */
+        pInB = pScratch;
+        col = numColsB;
+
+        while (col > 0U)
+        {
+            /* C[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + ... */
+            *pOut++ = simd_mat_dot_s16(pInA, pInB, numColsA);
+
+            /* Move to the next row of the transposed B */
+            pInB += stride;
+
+            /* Decrement the column loop counter */
+            col--;
+        }
+
+        /* Move to the next row of A */
+        pInA += numColsA;
+
+        /* Decrement the row loop counter */
+        row--;
+    }
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    int64_t sum; /* accumulator */
+    int16_t *pRowA; /* current element of the row of A */
+    uint32_t colCnt; /* inner loop counter */
+
+    (void) pScratch;
+
+    while (row > 0U)
+    {
+        col = 0U;
+
+        while (col < numColsB)
+        {
+            /* Walk along the row of A and down the column of B */
+            pRowA = pInA;
+            pInB = pSrcB->pData + col;
+            sum = 0;
+            colCnt = numColsA;
+
+            while (colCnt > 0U)
+            {
+                /* C[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + ... */
+                sum += (int32_t) *pRowA++ * *pInB;
+                pInB += numColsB;
+
+                /* Decrement the loop counter */
+                colCnt--;
+            }
+
+            /* Convert the result from 34.30 to 1.15 format and store it */
+            *pOut++ = simd_mat_result_s16(sum);
+
+            /* Increment the column loop counter */
+            col++;
+        }
+
+        /* Move to the next row of A */
+        pInA += numColsA;
+
+        /* Decrement the row loop counter */
+        row--;
+    }
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+}
+
+/**
+ * @brief S16 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix, of size M x N
+ * @param[in]       *pVec points to the 32-bit aligned input vector, of length N
+ * @param[out]      *pDst points to the output vector, of length M
+ * @return none.
+ *
+ * @details
+ * The rows of the matrix are read with unaligned-safe loads, so any number of columns is supported.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The function is implemented using a 64-bit internal accumulator.
+ * The result is truncated to 34.15 format and saturated to 1.15 format.
+ */
+void simd_mat_vec_s16(const simd_matrix_instance_s16 *pSrcMat,
+    int16_t *pVec,
+    int16_t *pDst)
+{
+    int16_t *pInA = pSrcMat->pData; /* input data matrix pointer */
+    uint16_t numCols = pSrcMat->numCols; /* number of columns of the matrix */
+    uint32_t row = pSrcMat->numRows; /* row loop counter */
+
+    while (row > 0U)
+    {
+        /* y[i] = A[i][0] * x[0] + A[i][1] * x[1] + ... */
+        *pDst++ = simd_mat_dot_s16(pInA, pVec, numCols);
+
+        /* Move to the next row of the matrix */
+        pInA += numCols;
+
+        /* Decrement the row loop counter */
+        row--;
+    }
+}
+
+/**
+ * @brief S16 3x3 matrix multiplication.
+ * @param[in]       *pSrcA points to the first input matrix data, in row-major order
+ * @param[in]       *pSrcB points to the second input matrix data, in row-major order
+ * @param[out]      *pDst points to the output matrix data, in row-major order
+ * @return none.
+ *
+ * @details
+ * Fixed-size variant of simd_mat_mult_s16() without scratch buffer and alignment requirements.
+ * On Cortex-M4 the body is straight-line: the rows of A and the columns of B are packed
+ * into halfword pairs once, then every output takes one dual multiply-accumulate
+ * and one scalar multiply-accumulate.
+ */
+void simd_mat_mult_3x3_s16(int16_t *pSrcA,
+    int16_t *pSrcB,
+    int16_t *pDst)
+{
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t a0, a1, a2; /* packed {A[i][0], A[i][1]} */
+    int32_t b0, b1, b2; /* packed {B[0][j], B[1][j]} */
+
+    a0 = __PKHBT16(pSrcA[0], pSrcA[1]);
+    a1 = __PKHBT16(pSrcA[3], pSrcA[4]);
+    a2 = __PKHBT16(pSrcA[6], pSrcA[7]);
+
+    b0 = __PKHBT16(pSrcB[0], pSrcB[3]);
+    b1 = __PKHBT16(pSrcB[1], pSrcB[4]);
+    b2 = __PKHBT16(pSrcB[2], pSrcB[5]);
+
+    /* C[i][j] = A[i][0] * B[0][j] + A[i][1] * B[1][j] + A[i][2] * B[2][j] */
+    pDst[0] = simd_mat_result_s16((int64_t) __SMLALD(a0, b0, (int64_t) pSrcA[2] * pSrcB[6]));
+    pDst[1] = simd_mat_result_s16((int64_t) __SMLALD(a0, b1, (int64_t) pSrcA[2] * pSrcB[7]));
+    pDst[2] = simd_mat_result_s16((int64_t) __SMLALD(a0, b2, (int64_t) pSrcA[2] * pSrcB[8]));
+    pDst[3] = simd_mat_result_s16((int64_t) __SMLALD(a1, b0, (int64_t) pSrcA[5] * pSrcB[6]));
+    pDst[4] = simd_mat_result_s16((int64_t) __SMLALD(a1, b1, (int64_t) pSrcA[5] * pSrcB[7]));
+    pDst[5] = simd_mat_result_s16((int64_t) __SMLALD(a1, b2, (int64_t) pSrcA[5] * pSrcB[8]));
+    pDst[6] = simd_mat_result_s16((int64_t) __SMLALD(a2, b0, (int64_t) pSrcA[8] * pSrcB[6]));
+    pDst[7] = simd_mat_result_s16((int64_t) __SMLALD(a2, b1, (int64_t) pSrcA[8] * pSrcB[7]));
+    pDst[8] = simd_mat_result_s16((int64_t) __SMLALD(a2, b2, (int64_t) pSrcA[8] * pSrcB[8]));
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    simd_matrix_instance_s16 A, B, C;
+
+    simd_mat_init_s16(&A, 3U, 3U, pSrcA);
+    simd_mat_init_s16(&B, 3U, 3U, pSrcB);
+    simd_mat_init_s16(&C, 3U, 3U, pDst);
+    simd_mat_mult_s16(&A, &B, &C, NULL);
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+}
+
+/**
+ * @brief S16 4x4 matrix multiplication.
+ * @param[in]       *pSrcA points to the 32-bit aligned first input matrix data, in row-major order
+ * @param[in]       *pSrcB points to the second input matrix data, in row-major order
+ * @param[out]      *pDst points to the 32-bit aligned output matrix data, in row-major order
+ * @return none.
+ *
+ * @details
+ * Fixed-size variant of simd_mat_mult_s16() without scratch buffer.
+ * On Cortex-M4 the body is straight-line: the columns of B are packed into halfword pairs
+ * once, then every output takes two dual multiply-accumulates and every output row
+ * is stored as two packed words.
+ */
+void simd_mat_mult_4x4_s16(int16_t *pSrcA,
+    int16_t *pSrcB,
+    int16_t *pDst)
+{
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    __SIMD32_TYPE *pA = __SIMD32_CONST(pSrcA);
+    __SIMD32_TYPE *pC = __SIMD32_CONST(pDst);
+    int32_t a0, a1; /* packed row of A */
+    int32_t b00, b01, b10, b11, b20, b21, b30, b31; /* packed columns of B */
+    int16_t c0, c1, c2, c3; /* row of C */
+
+    /* b[j][0] = {B[0][j], B[1][j]}, b[j][1] = {B[2][j], B[3][j]} */
+    b00 = __PKHBT16(pSrcB[0], pSrcB[4]);
+    b01 = __PKHBT16(pSrcB[8], pSrcB[12]);
+    b10 = __PKHBT16(pSrcB[1], pSrcB[5]);
+    b11 = __PKHBT16(pSrcB[9], pSrcB[13]);
+    b20 = __PKHBT16(pSrcB[2], pSrcB[6]);
+    b21 = __PKHBT16(pSrcB[10], pSrcB[14]);
+    b30 = __PKHBT16(pSrcB[3], pSrcB[7]);
+    b31 = __PKHBT16(pSrcB[11], pSrcB[15]);
+
+    /* C[0][j] */
+    a0 = pA[0];
+    a1 = pA[1];
+    c0 = simd_mat_result_s16((int64_t) __SMLALD(a1, b01, __SMLALD(a0, b00, 0)));
+    c1 = simd_mat_result_s16((int64_t) __SMLALD(a1, b11, __SMLALD(a0, b10, 0)));
+    c2 = simd_mat_result_s16((int64_t) __SMLALD(a1, b21, __SMLALD(a0, b20, 0)));
+    c3 = simd_mat_result_s16((int64_t) __SMLALD(a1, b31, __SMLALD(a0, b30, 0)));
+    pC[0] = __PKHBT16(c0, c1);
+    pC[1] = __PKHBT16(c2, c3);
+
+    /* C[1][j] */
+    a0 = pA[2];
+    a1 = pA[3];
+    c0 = simd_mat_result_s16((int64_t) __SMLALD(a1, b01, __SMLALD(a0, b00, 0)));
+    c1 = simd_mat_result_s16((int64_t) __SMLALD(a1, b11, __SMLALD(a0, b10, 0)));
+    c2 = simd_mat_result_s16((int64_t) __SMLALD(a1, b21, __SMLALD(a0, b20, 0)));
+    c3 = simd_mat_result_s16((int64_t) __SMLALD(a1, b31, __SMLALD(a0, b30, 0)));
+    pC[2] = __PKHBT16(c0, c1);
+    pC[3] = __PKHBT16(c2, c3);
+
+    /* C[2][j] */
+    a0 = pA[4];
+    a1 = pA[5];
+    c0 = simd_mat_result_s16((int64_t) __SMLALD(a1, b01, __SMLALD(a0, b00, 0)));
+    c1 = simd_mat_result_s16((int64_t) __SMLALD(a1, b11, __SMLALD(a0, b10, 0)));
+    c2 = simd_mat_result_s16((int64_t) __SMLALD(a1, b21, __SMLALD(a0, b20, 0)));
+    c3 = simd_mat_result_s16((int64_t) __SMLALD(a1, b31, __SMLALD(a0, b30, 0)));
+    pC[4] = __PKHBT16(c0, c1);
+    pC[5] = __PKHBT16(c2, c3);
+
+    /* C[3][j] */
+    a0 = pA[6];
+    a1 = pA[7];
+    c0 = simd_mat_result_s16((int64_t) __SMLALD(a1, b01, __SMLALD(a0, b00, 0)));
+    c1 = simd_mat_result_s16((int64_t) __SMLALD(a1, b11, __SMLALD(a0, b10, 0)));
+    c2 = simd_mat_result_s16((int64_t) __SMLALD(a1, b21, __SMLALD(a0, b20, 0)));
+    c3 = simd_mat_result_s16((int64_t) __SMLALD(a1, b31, __SMLALD(a0, b30, 0)));
+    pC[6] = __PKHBT16(c0, c1);
+    pC[7] = __PKHBT16(c2, c3);
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    simd_matrix_instance_s16 A, B, C;
+
+    simd_mat_init_s16(&A, 4U, 4U, pSrcA);
+    simd_mat_init_s16(&B, 4U, 4U, pSrcB);
+    simd_mat_init_s16(&C, 4U, 4U, pDst);
+    simd_mat_mult_s16(&A, &B, &C, NULL);
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+}
+
+/**
+ * @brief S16 3x3 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the input matrix data, in row-major order
+ * @param[in]       *pVec points to the input vector, of length 3
+ * @param[out]      *pDst points to the output vector, of length 3
+ * @return none.
+ *
+ * @details
+ * Fixed-size variant of simd_mat_vec_s16() without alignment requirements.
+ * On Cortex-M4 the body is straight-line, with one dual and one scalar multiply-accumulate per output.
+ */
+void simd_mat_vec_3x3_s16(int16_t *pSrcMat,
+    int16_t *pVec,
+    int16_t *pDst)
+{
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t v0; /* packed {x[0], x[1]} */
+
+    v0 = __PKHBT16(pVec[0], pVec[1]);
+
+    /* y[i] = A[i][0] * x[0] + A[i][1] * x[1] + A[i][2] * x[2] */
+    pDst[0] = simd_mat_result_s16((int64_t) __SMLALD(__PKHBT16(pSrcMat[0], pSrcMat[1]), v0,
+        (int64_t) pSrcMat[2] * pVec[2]));
+    pDst[1] = simd_mat_result_s16((int64_t) __SMLALD(__PKHBT16(pSrcMat[3], pSrcMat[4]), v0,
+        (int64_t) pSrcMat[5] * pVec[2]));
+    pDst[2] = simd_mat_result_s16((int64_t) __SMLALD(__PKHBT16(pSrcMat[6], pSrcMat[7]), v0,
+        (int64_t) pSrcMat[8] * pVec[2]));
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    simd_matrix_instance_s16 A;
+
+    simd_mat_init_s16(&A, 3U, 3U, pSrcMat);
+    simd_mat_vec_s16(&A, pVec, pDst);
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+}
+
+/**
+ * @brief S16 4x4 matrix and vector multiplication.
+ * @param[in]       *pSrcMat points to the 32-bit aligned input matrix data, in row-major order
+ * @param[in]       *pVec points to the 32-bit aligned input vector, of length 4
+ * @param[out]      *pDst points to the output vector, of length 4
+ * @return none.
+ *
+ * @details
+ * Fixed-size variant of simd_mat_vec_s16().
+ * On Cortex-M4 the body is straight-line, with two dual multiply-accumulates per output.
+ */
+void simd_mat_vec_4x4_s16(int16_t *pSrcMat,
+    int16_t *pVec,
+    int16_t *pDst)
+{
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    __SIMD32_TYPE *pA = __SIMD32_CONST(pSrcMat);
+    int32_t v0 = __SIMD32_CONST(pVec)[0]; /* packed {x[0], x[1]} */
+    int32_t v1 = __SIMD32_CONST(pVec)[1]; /* packed {x[2], x[3]} */
+
+    /* y[i] = A[i][0] * x[0] + A[i][1] * x[1] + A[i][2] * x[2] + A[i][3] * x[3] */
+    pDst[0] = simd_mat_result_s16((int64_t) __SMLALD(pA[1], v1, __SMLALD(pA[0], v0, 0)));
+    pDst[1] = simd_mat_result_s16((int64_t) __SMLALD(pA[3], v1, __SMLALD(pA[2], v0, 0)));
+    pDst[2] = simd_mat_result_s16((int64_t) __SMLALD(pA[5], v1, __SMLALD(pA[4], v0, 0)));
+    pDst[3] = simd_mat_result_s16((int64_t) __SMLALD(pA[7], v1, __SMLALD(pA[6], v0, 0)));
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    simd_matrix_instance_s16 A;
+
+    simd_mat_init_s16(&A, 4U, 4U, pSrcMat);
+    simd_mat_vec_s16(&A, pVec, pDst);
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+}
+
+/**
+ * @brief Dot product of two S16 vectors, saturated to 1.15 format.
+ * @param[in]       *pSrcA points to the first input vector, any alignment
+ * @param[in]       *pSrcB points to the 32-bit aligned second input vector
+ * @param[in]       blockSize number of samples in each vector
+ * @return dot product.
+ */
+static inline int16_t simd_mat_dot_s16(int16_t *pSrcA,
+    int16_t *pSrcB,
+    uint32_t blockSize)
+{
+    int64_t sum = 0; /* accumulator */
+    uint32_t blkCnt; /* loop counter */
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t inA; /* packed input A */
+    int32_t inB; /* packed input B */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 1U;
+
+    /* First part of the processing with loop unrolling.  Compute 2 products at a time.
+     ** a second part below computes the remaining product. */
+    while (blkCnt > 0U)
+    {
+        /* sum += A[n] * B[n] + A[n+1] * B[n+1] */
+        inA = simd_mat_read_pair_s16(pSrcA);
+        pSrcA += 2;
+        inB = *__SIMD32(pSrcB)++;
+        sum = (int64_t) __SMLALD(inA, inB, sum);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 2, compute the remaining product here. */
+    blkCnt = blockSize & 0x1U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+        /* sum += A[n] * B[n] */
+        sum += (int32_t) *pSrcA++ * *pSrcB++;
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    return simd_mat_result_s16(sum);
+}
+
+/**
+ * @brief Converts an accumulator from 34.30 to 1.15 format.
+ * @param[in]       sum accumulator
+ * @return truncated and saturated result.
+ */
+static inline int16_t simd_mat_result_s16(int64_t sum)
+{
+    return (int16_t) __SSAT((int32_t ) (sum >> 15), 16);
+}
+
+#if defined (USE_MATH_DSP)
+/**
+ * @brief Reads two S16 values from an address of any alignment.
+ * @param[in]       *pSrc points to the values
+ * @return packed values.
+ *
+ * @details
+ * The compiler emits a single word load where unaligned access is enabled,
+ * and halfword loads when built with -mno-unaligned-access (e.g. UNALIGN_TRP set).
+ */
+static inline int32_t simd_mat_read_pair_s16(int16_t *pSrc)
+{
+    int32_t pair;
+
+    memcpy(&pair, pSrc, sizeof(pair));
+    return pair;
+}
+#endif /* #if defined (USE_MATH_DSP) */
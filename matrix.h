@@ -0,0 +1,43 @@
+/*
+ * matrix.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#ifndef MATH_S16_MATRIX_H_
+#define MATH_S16_MATRIX_H_
+
+#include "math.h"
+
+/**
+ * @brief Length of the scratch buffer of simd_mat_mult_s16() for a second matrix of N x P.
+ */
+#define SIMD_MAT_SCRATCH_LEN(N, P)  ((((N) + 1U) & ~0x1U) * (P))
+
+/**
+ * @brief Instance structure for the S16 matrix, stored in row-major order.
+ */
+typedef struct
+{
+    uint16_t numRows; /* number of rows of the matrix */
+    uint16_t numCols; /* number of columns of the matrix */
+    int16_t *pData; /* points to the data of the matrix */
+} simd_matrix_instance_s16;
+
+/* Public function prototypes */
+void simd_mat_init_s16(simd_matrix_instance_s16 *S, uint16_t nRows,
+    uint16_t nColumns, int16_t *pData);
+void simd_mat_trans_s16(const simd_matrix_instance_s16 *pSrc,
+    simd_matrix_instance_s16 *pDst);
+void simd_mat_mult_s16(const simd_matrix_instance_s16 *pSrcA,
+    const simd_matrix_instance_s16 *pSrcB, simd_matrix_instance_s16 *pDst,
+    int16_t *pScratch);
+void simd_mat_vec_s16(const simd_matrix_instance_s16 *pSrcMat, int16_t *pVec,
+    int16_t *pDst);
+void simd_mat_mult_3x3_s16(int16_t *pSrcA, int16_t *pSrcB, int16_t *pDst);
+void simd_mat_mult_4x4_s16(int16_t *pSrcA, int16_t *pSrcB, int16_t *pDst);
+void simd_mat_vec_3x3_s16(int16_t *pSrcMat, int16_t *pVec, int16_t *pDst);
+void simd_mat_vec_4x4_s16(int16_t *pSrcMat, int16_t *pVec, int16_t *pDst);
+
+#endif /* MATH_S16_MATRIX_H_ */
@@ -0,0 +1,226 @@
+/*
+ * tables.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#include "tables.h"
+
+/*
+ * All tables are declared const so they are placed in flash (rodata) instead of RAM,
+ * and 32-bit aligned so they can be read as halfword pairs.
+ * The values are rounded to nearest and saturated to 1.15 format:
+ *     table[n] = min(round(f(n) * 32768), 32767)
+ * The unsigned interpolation tables are not saturated, 1.0 is stored as 32768.
+ *
+ * Window tables hold the first SIMD_WINDOW_HALF_LEN(N) samples of a symmetric window,
+ * the second half is mirrored at run time: w[n] = w[N - 1 - n].
+ *
+ * This file is generated by tables.py, edit the script and run
+ *     python3 tables.py > tables.c
+ * to add a window length, a window type or a table.
+ */
+
+/**
+ * @brief Hann window, N = 128, symmetric half.
+ * \par
+ * w[n] = 0.5 - 0.5 * cos(2 * pi * n / (N - 1))
+ */
+__ALIGNED(4) const int16_t simd_hann_128_s16[SIMD_WINDOW_HALF_LEN(128U)] = {
+    0, 20, 80, 180, 320, 499, 717, 973,
+    1267, 1597, 1965, 2367, 2804, 3273, 3775, 4308,
+    4871, 5461, 6078, 6721, 7387, 8075, 8784, 9511,
+    10255, 11014, 11786, 12569, 13362, 14162, 14967, 15776,
+    16587, 17397, 18204, 19007, 19804, 20592, 21370, 22136,
+    22887, 23623, 24341, 25039, 25717, 26371, 27001, 27606,
+    28182, 28730, 29247, 29734, 30187, 30607, 30991, 31341,
+    31653, 31928, 32165, 32364, 32523, 32643, 32723, 32763
+};
+
+/**
+ * @brief Hamming window, N = 128, symmetric half.
+ * \par
+ * w[n] = 0.54 - 0.46 * cos(2 * pi * n / (N - 1))
+ */
+__ALIGNED(4) const int16_t simd_hamming_128_s16[SIMD_WINDOW_HALF_LEN(128U)] = {
+    2621, 2640, 2695, 2787, 2916, 3080, 3281, 3516,
+    3787, 4091, 4429, 4799, 5201, 5633, 6095, 6585,
+    7102, 7646, 8214, 8805, 9418, 10051, 10703, 11371,
+    12056, 12754, 13464, 14185, 14914, 15650, 16391, 17136,
+    17881, 18626, 19369, 20108, 20841, 21566, 22282, 22986,
+    23678, 24354, 25015, 25658, 26281, 26883, 27463, 28019,
+    28549, 29053, 29529, 29976, 30393, 30780, 31134, 31455,
+    31742, 31995, 32213, 32396, 32543, 32653, 32727, 32763
+};
+
+/**
+ * @brief Blackman window, N = 128, symmetric half.
+ * \par
+ * w[n] = 0.42 - 0.5 * cos(2 * pi * n / (N - 1)) + 0.08 * cos(4 * pi * n / (N - 1))
+ */
+__ALIGNED(4) const int16_t simd_blackman_128_s16[SIMD_WINDOW_HALF_LEN(128U)] = {
+    0, 7, 29, 65, 117, 184, 268, 369,
+    487, 625, 783, 962, 1163, 1388, 1638, 1913,
+    2217, 2549, 2910, 3302, 3725, 4181, 4669, 5191,
+    5746, 6334, 6956, 7610, 8297, 9015, 9764, 10541,
+    11345, 12174, 13026, 13899, 14789, 15695, 16612, 17539,
+    18470, 19403, 20335, 21260, 22175, 23077, 23960, 24822,
+    25658, 26464, 27236, 27971, 28665, 29315, 29916, 30467,
+    30964, 31404, 31786, 32108, 32367, 32563, 32694, 32760
+};
+
+/**
+ * @brief Hann window, N = 256, symmetric half.
+ * \par
+ * w[n] = 0.5 - 0.5 * cos(2 * pi * n / (N - 1))
+ */
+__ALIGNED(4) const int16_t simd_hann_256_s16[SIMD_WINDOW_HALF_LEN(256U)] = {
+    0, 5, 20, 45, 80, 124, 179, 243,
+    317, 401, 495, 598, 711, 833, 965, 1106,
+    1257, 1416, 1585, 1763, 1949, 2145, 2349, 2561,
+    2782, 3011, 3249, 3494, 3747, 4008, 4276, 4552,
+    4834, 5124, 5421, 5724, 6034, 6350, 6672, 7000,
+    7334, 7673, 8018, 8367, 8722, 9081, 9445, 9812,
+    10184, 10560, 10939, 11321, 11707, 12095, 12486, 12879,
+    13274, 13672, 14070, 14471, 14872, 15275, 15678, 16081,
+    16485, 16889, 17292, 17695, 18097, 18498, 18897, 19295,
+    19692, 20086, 20478, 20868, 21255, 21639, 22019, 22397,
+    22770, 23140, 23506, 23867, 24224, 24576, 24923, 25265,
+    25602, 25932, 26258, 26577, 26890, 27196, 27496, 27789,
+    28076, 28355, 28627, 28892, 29148, 29398, 29639, 29872,
+    30097, 30314, 30522, 30722, 30913, 31095, 31268, 31432,
+    31588, 31733, 31870, 31997, 32115, 32223, 32321, 32410,
+    32489, 32558, 32618, 32667, 32707, 32737, 32757, 32767
+};
+
+/**
+ * @brief Hamming window, N = 256, symmetric half.
+ * \par
+ * w[n] = 0.54 - 0.46 * cos(2 * pi * n / (N - 1))
+ */
+__ALIGNED(4) const int16_t simd_hamming_256_s16[SIMD_WINDOW_HALF_LEN(256U)] = {
+    2621, 2626, 2640, 2663, 2695, 2736, 2786, 2845,
+    2913, 2991, 3077, 3172, 3276, 3388, 3509, 3639,
+    3778, 3925, 4080, 4243, 4415, 4595, 4782, 4978,
+    5181, 5392, 5610, 5836, 6069, 6309, 6555, 6809,
+    7069, 7336, 7609, 7888, 8173, 8464, 8760, 9062,
+    9369, 9681, 9998, 10319, 10646, 10976, 11310, 11649,
+    11991, 12336, 12685, 13037, 13391, 13749, 14108, 14470,
+    14834, 15199, 15566, 15935, 16304, 16674, 17045, 17416,
+    17788, 18159, 18530, 18900, 19270, 19639, 20007, 20373,
+    20738, 21101, 21461, 21820, 22176, 22529, 22879, 23226,
+    23570, 23910, 24247, 24579, 24907, 25231, 25551, 25865,
+    26175, 26479, 26778, 27072, 27360, 27642, 27918, 28188,
+    28451, 28708, 28958, 29202, 29438, 29667, 29889, 30104,
+    30311, 30510, 30702, 30886, 31061, 31229, 31388, 31539,
+    31682, 31816, 31942, 32059, 32167, 32266, 32357, 32439,
+    32511, 32575, 32630, 32675, 32712, 32739, 32758, 32767
+};
+
+/**
+ * @brief Blackman window, N = 256, symmetric half.
+ * \par
+ * w[n] = 0.42 - 0.5 * cos(2 * pi * n / (N - 1)) + 0.08 * cos(4 * pi * n / (N - 1))
+ */
+__ALIGNED(4) const int16_t simd_blackman_256_s16[SIMD_WINDOW_HALF_LEN(256U)] = {
+    0, 2, 7, 16, 29, 45, 65, 89,
+    116, 148, 183, 222, 266, 314, 366, 422,
+    483, 549, 620, 695, 776, 862, 953, 1050,
+    1153, 1261, 1376, 1496, 1623, 1757, 1897, 2043,
+    2197, 2358, 2526, 2701, 2883, 3074, 3272, 3477,
+    3691, 3912, 4142, 4380, 4626, 4880, 5142, 5413,
+    5692, 5979, 6275, 6579, 6891, 7211, 7540, 7876,
+    8220, 8572, 8932, 9299, 9674, 10056, 10445, 10840,
+    11242, 11651, 12065, 12485, 12911, 13342, 13778, 14218,
+    14662, 15111, 15563, 16017, 16475, 16935, 17397, 17860,
+    18324, 18789, 19253, 19718, 20182, 20644, 21104, 21563,
+    22018, 22470, 22919, 23363, 23802, 24237, 24665, 25087,
+    25503, 25911, 26312, 26704, 27088, 27462, 27828, 28183,
+    28527, 28861, 29183, 29494, 29793, 30079, 30352, 30613,
+    30859, 31092, 31311, 31515, 31705, 31880, 32039, 32183,
+    32312, 32425, 32522, 32603, 32668, 32717, 32750, 32766
+};
+
+/**
+ * @brief Twiddle factors for a 256-point FFT.
+ * \par
+ * Stored as interleaved pairs for k = 0 .. N/2 - 1:
+ * <pre>
+ *     table[2k]     = cos(2 * pi * k / N)
+ *     table[2k + 1] = sin(2 * pi * k / N)
+ * </pre>
+ * Smaller power-of-two FFT sizes use the same table with a stride of 256 / N pairs.
+ */
+__ALIGNED(4) const int16_t simd_twiddle_256_s16[256] = {
+    32767, 0, 32758, 804, 32729, 1608, 32679, 2411,
+    32610, 3212, 32522, 4011, 32413, 4808, 32286, 5602,
+    32138, 6393, 31972, 7180, 31786, 7962, 31581, 8740,
+    31357, 9512, 31114, 10279, 30853, 11039, 30572, 11793,
+    30274, 12540, 29957, 13279, 29622, 14010, 29269, 14733,
+    28899, 15447, 28511, 16151, 28106, 16846, 27684, 17531,
+    27246, 18205, 26791, 18868, 26320, 19520, 25833, 20160,
+    25330, 20788, 24812, 21403, 24279, 22006, 23732, 22595,
+    23170, 23170, 22595, 23732, 22006, 24279, 21403, 24812,
+    20788, 25330, 20160, 25833, 19520, 26320, 18868, 26791,
+    18205, 27246, 17531, 27684, 16846, 28106, 16151, 28511,
+    15447, 28899, 14733, 29269, 14010, 29622, 13279, 29957,
+    12540, 30274, 11793, 30572, 11039, 30853, 10279, 31114,
+    9512, 31357, 8740, 31581, 7962, 31786, 7180, 31972,
+    6393, 32138, 5602, 32286, 4808, 32413, 4011, 32522,
+    3212, 32610, 2411, 32679, 1608, 32729, 804, 32758,
+    0, 32767, -804, 32758, -1608, 32729, -2411, 32679,
+    -3212, 32610, -4011, 32522, -4808, 32413, -5602, 32286,
+    -6393, 32138, -7180, 31972, -7962, 31786, -8740, 31581,
+    -9512, 31357, -10279, 31114, -11039, 30853, -11793, 30572,
+    -12540, 30274, -13279, 29957, -14010, 29622, -14733, 29269,
+    -15447, 28899, -16151, 28511, -16846, 28106, -17531, 27684,
+    -18205, 27246, -18868, 26791, -19520, 26320, -20160, 25833,
+    -20788, 25330, -21403, 24812, -22006, 24279, -22595, 23732,
+    -23170, 23170, -23732, 22595, -24279, 22006, -24812, 21403,
+    -25330, 20788, -25833, 20160, -26320, 19520, -26791, 18868,
+    -27246, 18205, -27684, 17531, -28106, 16846, -28511, 16151,
+    -28899, 15447, -29269, 14733, -29622, 14010, -29957, 13279,
+    -30274, 12540, -30572, 11793, -30853, 11039, -31114, 10279,
+    -31357, 9512, -31581, 8740, -31786, 7962, -31972, 7180,
+    -32138, 6393, -32286, 5602, -32413, 4808, -32522, 4011,
+    -32610, 3212, -32679, 2411, -32729, 1608, -32758, 804
+};
+
+/**
+ * @brief Reciprocal table for m in [0.5 1), 32 segments for linear interpolation.
+ * \par
+ * table[k] = 1 / (2 * m), m = 0.5 + k / 64, k = 0 .. 32
+ */
+__ALIGNED(4) const uint16_t simd_recip_table_u16[33] = {
+    32768, 31775, 30840, 29959, 29127, 28340, 27594, 26887,
+    26214, 25575, 24966, 24385, 23831, 23302, 22795, 22310,
+    21845, 21400, 20972, 20560, 20165, 19784, 19418, 19065,
+    18725, 18396, 18079, 17772, 17476, 17190, 16913, 16644,
+    16384
+};
+
+/**
+ * @brief Reciprocal square root table for m in [0.25 1), 24 segments for linear interpolation.
+ * \par
+ * table[k] = 1 / (2 * sqrt(m)), m = (k + 8) / 32, k = 0 .. 24
+ */
+__ALIGNED(4) const uint16_t simd_rsqrt_table_u16[25] = {
+    32768, 30894, 29309, 27945, 26755, 25705, 24770, 23930,
+    23170, 22479, 21845, 21263, 20724, 20225, 19760, 19326,
+    18919, 18536, 18176, 17837, 17515, 17211, 16921, 16646,
+    16384
+};
+
+/**
+ * @brief Base-2 logarithm table for m in [1 2), 32 segments for linear interpolation.
+ * \par
+ * table[k] = log2(m), m = 1 + k / 32, k = 0 .. 32
+ */
+__ALIGNED(4) const uint16_t simd_log2_table_u16[33] = {
+    0, 1455, 2866, 4236, 5568, 6863, 8124, 9352,
+    10549, 11716, 12855, 13968, 15055, 16117, 17156, 18173,
+    19168, 20143, 21098, 22034, 22952, 23852, 24736, 25604,
+    26455, 27292, 28114, 28922, 29717, 30498, 31267, 32024,
+    32768
+};
@@ -0,0 +1,34 @@
+/*
+ * tables.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#ifndef MATH_S16_TABLES_H_
+#define MATH_S16_TABLES_H_
+
+#include "math.h"
+
+/**
+ * @brief Length of the symmetric-half window table for a window of N samples.
+ */
+#define SIMD_WINDOW_HALF_LEN(N)     (((N) + 1U) >> 1U)
+
+/* Symmetric-half window tables in 1.15 format, use with simd_window_sym_s16() */
+extern const int16_t simd_hann_128_s16[SIMD_WINDOW_HALF_LEN(128U)];
+extern const int16_t simd_hamming_128_s16[SIMD_WINDOW_HALF_LEN(128U)];
+extern const int16_t simd_blackman_128_s16[SIMD_WINDOW_HALF_LEN(128U)];
+extern const int16_t simd_hann_256_s16[SIMD_WINDOW_HALF_LEN(256U)];
+extern const int16_t simd_hamming_256_s16[SIMD_WINDOW_HALF_LEN(256U)];
+extern const int16_t simd_blackman_256_s16[SIMD_WINDOW_HALF_LEN(256U)];
+
+/* Twiddle factor table in 1.15 format, interleaved {cos, sin} */
+extern const int16_t simd_twiddle_256_s16[256];
+
+/* Interpolation tables in unsigned 1.15 format, used by the fast math functions */
+extern const uint16_t simd_recip_table_u16[33];
+extern const uint16_t simd_rsqrt_table_u16[25];
+extern const uint16_t simd_log2_table_u16[33];
+
+#endif /* MATH_S16_TABLES_H_ */
@@ -0,0 +1,144 @@
+#!/usr/bin/env python3
+#
+# tables.py
+#
+#  Created on: Oct 18, 2026
+#      Author: pudja
+#
+# Generates tables.c, usage: python3 tables.py > tables.c
+# New tables also need their extern declaration in tables.h.
+
+import math
+
+WINDOW_SIZES = (128, 256)
+TWIDDLE_SIZE = 256
+
+WINDOWS = (
+    ("hann", "Hann", "w[n] = 0.5 - 0.5 * cos(2 * pi * n / (N - 1))",
+     lambda n, N: 0.5 - 0.5 * math.cos(2 * math.pi * n / (N - 1))),
+    ("hamming", "Hamming", "w[n] = 0.54 - 0.46 * cos(2 * pi * n / (N - 1))",
+     lambda n, N: 0.54 - 0.46 * math.cos(2 * math.pi * n / (N - 1))),
+    ("blackman", "Blackman",
+     "w[n] = 0.42 - 0.5 * cos(2 * pi * n / (N - 1)) + 0.08 * cos(4 * pi * n / (N - 1))",
+     lambda n, N: 0.42 - 0.5 * math.cos(2 * math.pi * n / (N - 1))
+     + 0.08 * math.cos(4 * math.pi * n / (N - 1))),
+)
+
+HEADER = """/*
+ * tables.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#include "tables.h"
+
+/*
+ * All tables are declared const so they are placed in flash (rodata) instead of RAM,
+ * and 32-bit aligned so they can be read as halfword pairs.
+ * The values are rounded to nearest and saturated to 1.15 format:
+ *     table[n] = min(round(f(n) * 32768), 32767)
+ * The unsigned interpolation tables are not saturated, 1.0 is stored as 32768.
+ *
+ * Window tables hold the first SIMD_WINDOW_HALF_LEN(N) samples of a symmetric window,
+ * the second half is mirrored at run time: w[n] = w[N - 1 - n].
+ *
+ * This file is generated by tables.py, edit the script and run
+ *     python3 tables.py > tables.c
+ * to add a window length, a window type or a table.
+ */
+"""
+
+
+def s16(value):
+    """Rounds to nearest 1.15 and saturates."""
+    return max(-32768, min(32767, int(math.floor(value * 32768 + 0.5))))
+
+
+def u16(value):
+    """Rounds to nearest unsigned 1.15, 1.0 is kept as 32768."""
+    return min(65535, int(math.floor(value * 32768 + 0.5)))
+
+
+def body(values, per_line=8):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join("%d" % v for v in values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def main():
+    out = [HEADER]
+
+    for N in WINDOW_SIZES:
+        for name, title, formula, f in WINDOWS:
+            values = [s16(f(n, N)) for n in range((N + 1) // 2)]
+            out.append("""
+/**
+ * @brief %s window, N = %d, symmetric half.
+ * \\par
+ * %s
+ */
+__ALIGNED(4) const int16_t simd_%s_%d_s16[SIMD_WINDOW_HALF_LEN(%dU)] = {
+%s
+};
+""" % (title, N, formula, name, N, N, body(values)))
+
+    N = TWIDDLE_SIZE
+    values = []
+    for k in range(N // 2):
+        values += [s16(math.cos(2 * math.pi * k / N)), s16(math.sin(2 * math.pi * k / N))]
+    out.append("""
+/**
+ * @brief Twiddle factors for a %d-point FFT.
+ * \\par
+ * Stored as interleaved pairs for k = 0 .. N/2 - 1:
+ * <pre>
+ *     table[2k]     = cos(2 * pi * k / N)
+ *     table[2k + 1] = sin(2 * pi * k / N)
+ * </pre>
+ * Smaller power-of-two FFT sizes use the same table with a stride of %d / N pairs.
+ */
+__ALIGNED(4) const int16_t simd_twiddle_%d_s16[%d] = {
+%s
+};
+""" % (N, N, N, N, body(values)))
+
+    out.append("""
+/**
+ * @brief Reciprocal table for m in [0.5 1), 32 segments for linear interpolation.
+ * \\par
+ * table[k] = 1 / (2 * m), m = 0.5 + k / 64, k = 0 .. 32
+ */
+__ALIGNED(4) const uint16_t simd_recip_table_u16[33] = {
+%s
+};
+""" % body([u16(1 / (1 + k / 32)) for k in range(33)]))
+
+    out.append("""
+/**
+ * @brief Reciprocal square root table for m in [0.25 1), 24 segments for linear interpolation.
+ * \\par
+ * table[k] = 1 / (2 * sqrt(m)), m = (k + 8) / 32, k = 0 .. 24
+ */
+__ALIGNED(4) const uint16_t simd_rsqrt_table_u16[25] = {
+%s
+};
+""" % body([u16(1 / (2 * math.sqrt(k / 32))) for k in range(8, 33)]))
+
+    out.append("""
+/**
+ * @brief Base-2 logarithm table for m in [1 2), 32 segments for linear interpolation.
+ * \\par
+ * table[k] = log2(m), m = 1 + k / 32, k = 0 .. 32
+ */
+__ALIGNED(4) const uint16_t simd_log2_table_u16[33] = {
+%s
+};
+""" % body([u16(math.log2(1 + k / 32)) for k in range(33)]))
+
+    print("".join(out), end="")
+
+
+if __name__ == "__main__":
+    main()
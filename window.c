@@ -0,0 +1,208 @@
+/*
+ * window.c
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#include "window.h"
+
+/* Private function prototypes */
+static inline int16_t simd_mult_round_s16(int16_t a, int16_t b);
+#if defined (USE_MATH_DSP)
+static inline int32_t simd_mult_round_packed_s16(int32_t a, int32_t b);
+#endif /* #if defined (USE_MATH_DSP) */
+
+/**
+ * @brief Multiplies a S16 vector by a window table.
+ * @param[in]       *pSrc points to the 32-bit aligned input vector
+ * @param[in]       *pWindow points to the 32-bit aligned window table, of length blockSize
+ * @param[out]      *pDst points to the 32-bit aligned output vector
+ * @param[in]       blockSize number of samples in the vector
+ * @return none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The window is in 1.15 format. The 2.30 products are rounded to nearest
+ * and then saturated to 1.15 format.
+ */
+void simd_window_s16(int16_t *pSrc,
+    const int16_t *pWindow,
+    int16_t *pDst,
+    uint32_t blockSize)
+{
+    uint32_t blkCnt; /* loop counter */
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t in; /* packed input */
+    int32_t win; /* packed window */
+
+    /*loop Unrolling */
+    blkCnt = blockSize >> 2U;
+
+    /* First part of the processing with loop unrolling.  Compute 4 outputs at a time.
+     ** a second loop below computes the remaining 1 to 3 samples. */
+    while (blkCnt > 0U)
+    {
+        /* C = A * W */
+        /* Multiply two samples at a time and then store the results in the destination buffer. */
+        in = *__SIMD32(pSrc)++;
+        win = *__SIMD32(pWindow)++;
+        *__SIMD32(pDst)++ = simd_mult_round_packed_s16(in, win);
+
+        in = *__SIMD32(pSrc)++;
+        win = *__SIMD32(pWindow)++;
+        *__SIMD32(pDst)++ = simd_mult_round_packed_s16(in, win);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize % 0x4U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over blockSize number of values */
+    blkCnt = blockSize;
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+        /* C = A * W */
+        /* Multiply and then store the result in the destination buffer. */
+        *pDst++ = simd_mult_round_s16(*pSrc++, *pWindow++);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief Multiplies a S16 vector by a symmetric window stored as half a table.
+ * @param[in]       *pSrc points to the 32-bit aligned input vector
+ * @param[in]       *pHalfWindow points to the 32-bit aligned first half of the window, of length SIMD_WINDOW_HALF_LEN(blockSize)
+ * @param[out]      *pDst points to the 32-bit aligned output vector
+ * @param[in]       blockSize number of samples in the vector, equal to the full window length
+ * @return none.
+ *
+ * @details
+ * The second half of the window is mirrored from the first one, w[n] = w[blockSize - 1 - n],
+ * which halves the storage of the window tables in tables.h.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The window is in 1.15 format. The 2.30 products are rounded to nearest
+ * and then saturated to 1.15 format.
+ */
+void simd_window_sym_s16(int16_t *pSrc,
+    const int16_t *pHalfWindow,
+    int16_t *pDst,
+    uint32_t blockSize)
+{
+    uint32_t halfLen = SIMD_WINDOW_HALF_LEN(blockSize); /* length of the window table */
+    const int16_t *pWin; /* window pointer, walking backwards */
+    uint32_t blkCnt; /* loop counter */
+
+    /* First half, the window table is read forward */
+    simd_window_s16(pSrc, pHalfWindow, pDst, halfLen);
+    pSrc += halfLen;
+    pDst += halfLen;
+
+    /* Second half, the window table is read backward, skipping the middle sample of odd windows */
+    pWin = pHalfWindow + (blockSize - halfLen);
+
+#if defined (USE_MATH_DSP)
+
+    /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+    int32_t in; /* packed input */
+    int32_t win; /* packed window */
+    int16_t win1; /* first window value */
+    int16_t win2; /* second window value */
+    uint32_t restCnt = blockSize - halfLen; /* samples left in the second half */
+
+    /* For odd windows the second half starts on an odd sample, compute it first
+     ** so the pairs below stay 32-bit aligned. */
+    if (((halfLen & 0x1U) != 0U) && (restCnt > 0U))
+    {
+        *pDst++ = simd_mult_round_s16(*pSrc++, *--pWin);
+        restCnt--;
+    }
+
+    /*loop Unrolling */
+    blkCnt = restCnt >> 1U;
+
+    /* First part of the processing with loop unrolling.  Compute 2 outputs at a time.
+     ** a second loop below computes the remaining sample. */
+    while (blkCnt > 0U)
+    {
+        /* C = A * W */
+        /* Pack two mirrored window values and multiply two samples at a time. */
+        in = *__SIMD32(pSrc)++;
+        win1 = *--pWin;
+        win2 = *--pWin;
+        win = __PKHBT16(win1, win2);
+        *__SIMD32(pDst)++ = simd_mult_round_packed_s16(in, win);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+
+    /* If the rest of the half is not a multiple of 2, compute the remaining output sample here. */
+    blkCnt = restCnt & 0x1U;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+
+    /* Loop over the second half of the values */
+    blkCnt = blockSize - halfLen;
+
+#endif /* #if defined (USE_MATH_DSP) */
+
+    while (blkCnt > 0U)
+    {
+        /* C = A * W */
+        /* Multiply and then store the result in the destination buffer. */
+        *pDst++ = simd_mult_round_s16(*pSrc++, *--pWin);
+
+        /* Decrement the loop counter */
+        blkCnt--;
+    }
+}
+
+/**
+ * @brief Multiplies two 1.15 values with rounding.
+ * @param[in]       a first input
+ * @param[in]       b second input
+ * @return saturated 1.15 product.
+ */
+static inline int16_t simd_mult_round_s16(int16_t a,
+    int16_t b)
+{
+    /* Only -1 * -1 can overflow, the saturation handles it */
+    return (int16_t) __SSAT((((int32_t) a * b) + 0x4000) >> 15, 16);
+}
+
+#if defined (USE_MATH_DSP)
+/**
+ * @brief Multiplies two pairs of packed 1.15 values with rounding.
+ * @param[in]       a first packed input
+ * @param[in]       b second packed input
+ * @return packed saturated 1.15 products.
+ */
+static inline int32_t simd_mult_round_packed_s16(int32_t a,
+    int32_t b)
+{
+    return __PKHBT16(simd_mult_round_s16((int16_t) a, (int16_t) b),
+        simd_mult_round_s16((int16_t) (a >> 16), (int16_t) (b >> 16)));
+}
+#endif /* #if defined (USE_MATH_DSP) */
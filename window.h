@@ -0,0 +1,20 @@
+/*
+ * window.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: pudja
+ */
+
+#ifndef MATH_S16_WINDOW_H_
+#define MATH_S16_WINDOW_H_
+
+#include "math.h"
+#include "tables.h"
+
+/* Public function prototypes */
+void simd_window_s16(int16_t *pSrc, const int16_t *pWindow, int16_t *pDst,
+    uint32_t blockSize);
+void simd_window_sym_s16(int16_t *pSrc, const int16_t *pHalfWindow,
+    int16_t *pDst, uint32_t blockSize);
+
+#endif /* MATH_S16_WINDOW_H_ */